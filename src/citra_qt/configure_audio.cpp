@@ -17,8 +17,11 @@ ConfigureAudio::ConfigureAudio(QWidget* parent) :
 
     ui->output_sink_combo_box->clear();
     ui->output_sink_combo_box->addItem("auto");
-    for (const auto& sink_detail : AudioCore::g_sink_details) {
+    for (size_t i = 0; i < AudioCore::g_sink_details.size(); i++) {
+        const auto& sink_detail = AudioCore::g_sink_details[i];
         ui->output_sink_combo_box->addItem(sink_detail.id);
+        // Index 0 is the "auto" entry, which is also the fallback for unknown sink ids.
+        sink_index_map.emplace(sink_detail.id, static_cast<int>(i) + 1);
     }
 
     this->setConfiguration();
@@ -28,17 +31,12 @@ ConfigureAudio::~ConfigureAudio() {
 }
 
 void ConfigureAudio::setConfiguration() {
-    for (int index = 0; index < ui->output_sink_combo_box->count(); index++) {
-        if (ui->output_sink_combo_box->itemText(index).toStdString() == Settings::values.sink_id) {
-            ui->output_sink_combo_box->setCurrentIndex(index);
-            break;
-        }
-    }
-
-    ui->output_sink_combo_box->setCurrentIndex(0);
+    auto iter = sink_index_map.find(Settings::values.sink_id);
+    ui->output_sink_combo_box->setCurrentIndex(iter != sink_index_map.end() ? iter->second : 0);
 }
 
 void ConfigureAudio::applyConfiguration() {
-    Settings::values.sink_id = ui->output_sink_combo_box->itemText(ui->output_sink_combo_box->currentIndex()).toStdString();
+    int index = ui->output_sink_combo_box->currentIndex();
+    Settings::values.sink_id = index == 0 ? "auto" : AudioCore::g_sink_details[index - 1].id;
     Settings::Apply();
 }
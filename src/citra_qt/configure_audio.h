@@ -5,6 +5,8 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <QWidget>
 
 namespace Ui {
@@ -24,4 +26,7 @@ private:
     void setConfiguration();
 
     std::unique_ptr<Ui::ConfigureAudio> ui;
+
+    /// Maps sink ids from AudioCore::g_sink_details to their combo box index.
+    std::unordered_map<std::string, int> sink_index_map;
 };
@@ -29,6 +29,14 @@
     #define FORCE_INLINE inline __attribute__((always_inline))
 #endif
 
+// Marks error-path functions that should stay out of line (and, where supported, in a
+// cold text section) so they do not dilute the instruction cache of their callers.
+#ifdef _WIN32
+    #define COLD_NOINLINE __declspec(noinline)
+#else
+    #define COLD_NOINLINE __attribute__((cold, noinline))
+#endif
+
 #ifndef _MSC_VER
 
 #ifdef ARCHITECTURE_x86_64
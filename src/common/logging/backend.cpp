@@ -126,10 +126,14 @@ void SetFilter(Filter* new_filter) {
     filter = new_filter;
 }
 
+bool ShouldLog(Class log_class, Level log_level) {
+    return filter == nullptr || filter->CheckMessage(log_class, log_level);
+}
+
 void LogMessage(Class log_class, Level log_level,
                 const char* filename, unsigned int line_nr, const char* function,
                 const char* format, ...) {
-    if (filter != nullptr && !filter->CheckMessage(log_class, log_level))
+    if (!ShouldLog(log_class, log_level))
         return;
 
     va_list args;
@@ -86,6 +86,12 @@ enum class Class : ClassType {
     Count ///< Total number of logging classes
 };
 
+/**
+ * Returns true if a message with the given class and level would pass the current filter.
+ * Used by the logging macros to skip argument marshalling entirely for filtered messages.
+ */
+bool ShouldLog(Class log_class, Level log_level);
+
 /// Logs a message to the global logger.
 void LogMessage(Class log_class, Level log_level,
     const char* filename, unsigned int line_nr, const char* function,
@@ -101,7 +107,10 @@ void LogMessage(Class log_class, Level log_level,
 } // namespace Log
 
 #define LOG_GENERIC(log_class, log_level, ...) \
-    ::Log::LogMessage(log_class, log_level, __FILE__, __LINE__, __func__, __VA_ARGS__)
+    do { \
+        if (::Log::ShouldLog(log_class, log_level)) \
+            ::Log::LogMessage(log_class, log_level, __FILE__, __LINE__, __func__, __VA_ARGS__); \
+    } while (0)
 
 #ifdef _DEBUG
 #define LOG_TRACE(   log_class, ...) LOG_GENERIC(::Log::Class::log_class, ::Log::Level::Trace,    __VA_ARGS__)
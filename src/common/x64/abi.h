@@ -35,9 +35,11 @@
 #define ABI_PARAM4 ::Gen::R9
 
 // xmm0-xmm15 use the upper 16 bits in the functions that push/pop registers.
+#define ABI_ALL_CALLER_SAVED_GPR \
+    (BitSet32 { ::Gen::RAX, ::Gen::RCX, ::Gen::RDX, ::Gen::R8, ::Gen::R9, ::Gen::R10, ::Gen::R11 })
 #define ABI_ALL_CALLER_SAVED \
-    (BitSet32 { ::Gen::RAX, ::Gen::RCX, ::Gen::RDX, ::Gen::R8, ::Gen::R9, ::Gen::R10, ::Gen::R11, \
-                ::Gen::XMM0+16, ::Gen::XMM1+16, ::Gen::XMM2+16, ::Gen::XMM3+16, ::Gen::XMM4+16, ::Gen::XMM5+16 })
+    (ABI_ALL_CALLER_SAVED_GPR | \
+     BitSet32 { ::Gen::XMM0+16, ::Gen::XMM1+16, ::Gen::XMM2+16, ::Gen::XMM3+16, ::Gen::XMM4+16, ::Gen::XMM5+16 })
 #else //64-bit Unix / OS X
 
 #define ABI_PARAM1 ::Gen::RDI
@@ -47,13 +49,25 @@
 #define ABI_PARAM5 ::Gen::R8
 #define ABI_PARAM6 ::Gen::R9
 
-// TODO: Avoid pushing all 16 XMM registers when possible. Most functions we call probably
-// don't actually clobber them.
+#define ABI_ALL_CALLER_SAVED_GPR \
+    (BitSet32 { ::Gen::RAX, ::Gen::RCX, ::Gen::RDX, ::Gen::RDI, ::Gen::RSI, ::Gen::R8, ::Gen::R9, ::Gen::R10, ::Gen::R11 })
+
+// All 16 XMM registers are volatile in the SysV ABI, but most functions we call are
+// integer-only and don't actually clobber them. Callers that keep no live vector state
+// should save ABI_ALL_CALLER_SAVED_GPR only instead of pushing all 16 XMM registers.
 #define ABI_ALL_CALLER_SAVED \
-    (BitSet32 { ::Gen::RAX, ::Gen::RCX, ::Gen::RDX, ::Gen::RDI, ::Gen::RSI, ::Gen::R8, ::Gen::R9, ::Gen::R10, ::Gen::R11 } | \
-     ABI_ALL_FPRS)
+    (ABI_ALL_CALLER_SAVED_GPR | ABI_ALL_FPRS)
 #endif // WIN32
 
 #define ABI_ALL_CALLEE_SAVED (~ABI_ALL_CALLER_SAVED)
 
+// The set of caller-saved registers that actually needs preserving around a call to a
+// known helper. SysV marks all 16 XMM registers volatile while Win64 only marks
+// XMM0-XMM5, so an unconditional ABI_ALL_CALLER_SAVED spill moves three times as many
+// bytes on the SysV path. Pass false for helpers that have been audited to be
+// integer-only (e.g. the interpreter fallback and the Memory::* accessors) to skip
+// the XMM spill entirely.
+#define ABI_CALLER_SAVED_FOR(helper_uses_xmm) \
+    ((helper_uses_xmm) ? ABI_ALL_CALLER_SAVED : ABI_ALL_CALLER_SAVED_GPR)
+
 #define ABI_RETURN ::Gen::RAX
@@ -2,12 +2,53 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include "common/assert.h"
+
 #include "core/arm/jit_x64/jit_x64.h"
 
 namespace JitX64 {
 
-void JitX64::REV(Cond cond, ArmReg Rd, ArmReg Rm) { CompileInterpretInstruction(); }
-void JitX64::REV16(Cond cond, ArmReg Rd, ArmReg Rm) { CompileInterpretInstruction(); }
-void JitX64::REVSH(Cond cond, ArmReg Rd, ArmReg Rm) { CompileInterpretInstruction(); }
+using namespace Gen;
+
+void JitX64::REV(Cond cond, ArmReg Rd_index, ArmReg Rm_index) {
+    cond_manager.CompileCond(cond);
+
+    ASSERT_MSG(Rd_index != ArmReg::PC && Rm_index != ArmReg::PC, "UNPREDICTABLE");
+
+    CompileDataProcessingHelper(Rm_index, Rd_index, [&](X64Reg Rd) {
+        code->BSWAP(32, Rd);
+    });
+
+    current.arm_pc += GetInstSize();
+}
+
+void JitX64::REV16(Cond cond, ArmReg Rd_index, ArmReg Rm_index) {
+    cond_manager.CompileCond(cond);
+
+    ASSERT_MSG(Rd_index != ArmReg::PC && Rm_index != ArmReg::PC, "UNPREDICTABLE");
+
+    CompileDataProcessingHelper(Rm_index, Rd_index, [&](X64Reg Rd) {
+        // Swaps the bytes within each halfword.
+        code->BSWAP(32, Rd);
+        code->ROR(32, R(Rd), Imm8(16));
+    });
+
+    current.arm_pc += GetInstSize();
+}
+
+void JitX64::REVSH(Cond cond, ArmReg Rd_index, ArmReg Rm_index) {
+    cond_manager.CompileCond(cond);
+
+    ASSERT_MSG(Rd_index != ArmReg::PC && Rm_index != ArmReg::PC, "UNPREDICTABLE");
+
+    CompileDataProcessingHelper(Rm_index, Rd_index, [&](X64Reg Rd) {
+        // BSWAP places the byte-swapped low halfword in the top 16 bits,
+        // the arithmetic shift then sign-extends it back down.
+        code->BSWAP(32, Rd);
+        code->SAR(32, R(Rd), Imm8(16));
+    });
+
+    current.arm_pc += GetInstSize();
+}
 
 } // namespace JitX64
@@ -2,11 +2,70 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include "common/assert.h"
+
 #include "core/arm/jit_x64/jit_x64.h"
 
 namespace JitX64 {
 
-void JitX64::USAD8(Cond cond, ArmReg Rd, ArmReg Rm, ArmReg Rn) { CompileInterpretInstruction(); }
-void JitX64::USADA8(Cond cond, ArmReg Rd, ArmReg Ra, ArmReg Rm, ArmReg Rn) { CompileInterpretInstruction(); }
+using namespace Gen;
+
+// Both instructions use the host PSADBW instruction. MOVD zero-extends into the XMM
+// register, so the sum of absolute differences only covers the four low bytes and the
+// result fits in the low doubleword. XMM0 and XMM1 hold no guest state and are free
+// to clobber within a single instruction.
+
+void JitX64::USAD8(Cond cond, ArmReg Rd_index, ArmReg Rm_index, ArmReg Rn_index) {
+    cond_manager.CompileCond(cond);
+
+    ASSERT_MSG(Rd_index != ArmReg::PC && Rm_index != ArmReg::PC && Rn_index != ArmReg::PC, "UNPREDICTABLE");
+
+    OpArg Rn = reg_alloc.LockArmForRead(Rn_index);
+    code->MOVD_xmm(XMM0, Rn);
+    reg_alloc.UnlockArm(Rn_index);
+
+    OpArg Rm = reg_alloc.LockArmForRead(Rm_index);
+    code->MOVD_xmm(XMM1, Rm);
+    reg_alloc.UnlockArm(Rm_index);
+
+    code->PSADBW(XMM0, R(XMM1));
+
+    X64Reg Rd = reg_alloc.BindArmForWrite(Rd_index);
+    code->MOVD_xmm(R(Rd), XMM0);
+    reg_alloc.UnlockArm(Rd_index);
+
+    current.arm_pc += GetInstSize();
+}
+
+void JitX64::USADA8(Cond cond, ArmReg Rd_index, ArmReg Ra_index, ArmReg Rm_index, ArmReg Rn_index) {
+    cond_manager.CompileCond(cond);
+
+    ASSERT_MSG(Rd_index != ArmReg::PC && Ra_index != ArmReg::PC && Rm_index != ArmReg::PC && Rn_index != ArmReg::PC, "UNPREDICTABLE");
+
+    OpArg Rn = reg_alloc.LockArmForRead(Rn_index);
+    code->MOVD_xmm(XMM0, Rn);
+    reg_alloc.UnlockArm(Rn_index);
+
+    OpArg Rm = reg_alloc.LockArmForRead(Rm_index);
+    code->MOVD_xmm(XMM1, Rm);
+    reg_alloc.UnlockArm(Rm_index);
+
+    code->PSADBW(XMM0, R(XMM1));
+
+    X64Reg tmp = reg_alloc.AllocTemp();
+    code->MOVD_xmm(R(tmp), XMM0);
+
+    OpArg Ra = reg_alloc.LockArmForRead(Ra_index);
+    code->ADD(32, R(tmp), Ra);
+    reg_alloc.UnlockArm(Ra_index);
+
+    OpArg Rd = reg_alloc.LockArmForWrite(Rd_index);
+    code->MOV(32, Rd, R(tmp));
+    reg_alloc.UnlockArm(Rd_index);
+
+    reg_alloc.UnlockTemp(tmp);
+
+    current.arm_pc += GetInstSize();
+}
 
 } // namespace JitX64
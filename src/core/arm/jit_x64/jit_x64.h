@@ -399,6 +399,8 @@ private:
     void UHSUB16(Cond cond, ArmReg Rn, ArmReg Rd, ArmReg Rm) override;
 
     // Saturated Add/Subtract instructions
+    template <bool is_sub, bool is_double>
+    void CompileSaturatedArithmeticHelper(Cond cond, ArmReg Rn_index, ArmReg Rd_index, ArmReg Rm_index);
     void QADD(Cond cond, ArmReg Rn, ArmReg Rd, ArmReg Rm) override;
     void QSUB(Cond cond, ArmReg Rn, ArmReg Rd, ArmReg Rm) override;
     void QDADD(Cond cond, ArmReg Rn, ArmReg Rd, ArmReg Rm) override;
@@ -253,7 +253,7 @@ void RegAlloc::FlushEverything() {
 
 void RegAlloc::FlushABICallerSaved() {
     for (const X64State& x64_state : x64_gpr) {
-        if (!ABI_ALL_CALLER_SAVED[x64_state.x64_reg])
+        if (!ABI_ALL_CALLER_SAVED_GPR[x64_state.x64_reg])
             continue;
         if (x64_state.state != X64State::State::UserManuallyLocked) {
             ASSERT(!x64_state.locked);
@@ -264,7 +264,7 @@ void RegAlloc::FlushABICallerSaved() {
         }
     }
 
-    ASSERT(!ABI_ALL_CALLER_SAVED[JitStateReg()]);
+    ASSERT(!ABI_ALL_CALLER_SAVED_GPR[JitStateReg()]);
 }
 
 RegAlloc::X64State& RegAlloc::GetState(Gen::X64Reg x64_reg) {
@@ -178,6 +178,11 @@ public:
 
     /**
      * Allocates a handle for the given object.
+     *
+     * This performs no locking or heap allocation (the HLE kernel is single-threaded and the
+     * table is statically sized), so creating several handles back-to-back is already as cheap
+     * as it gets and needs no batched variant.
+     *
      * @return The created Handle or one of the following errors:
      *           - `ERR_OUT_OF_HANDLES`: the maximum number of handles has been exceeded.
      */
@@ -23,23 +23,31 @@
 namespace Service {
 namespace APT {
 
-/// Handle to shared memory region designated to for shared system font
-static Kernel::SharedPtr<Kernel::SharedMemory> shared_font_mem;
-static bool shared_font_relocated = false;
+/// Per-service state, kept in one struct so the fields the IPC handlers touch together also
+/// live together in memory. Ordered roughly by access frequency (parameter path first).
+struct APTState {
+    /// Parameter data to be returned in the next call to Glance/ReceiveParameter
+    MessageParameter next_parameter;
 
-static Kernel::SharedPtr<Kernel::Mutex> lock;
-static Kernel::SharedPtr<Kernel::Event> notification_event; ///< APT notification event
-static Kernel::SharedPtr<Kernel::Event> parameter_event; ///< APT parameter event
+    Kernel::SharedPtr<Kernel::Event> parameter_event; ///< APT parameter event
+    Kernel::SharedPtr<Kernel::Event> notification_event; ///< APT notification event
+    Kernel::SharedPtr<Kernel::Mutex> lock;
 
-static u32 cpu_percent; ///< CPU time available to the running application
+    u32 cpu_percent; ///< CPU time available to the running application
 
-/// Parameter data to be returned in the next call to Glance/ReceiveParameter
-static MessageParameter next_parameter;
+    /// Handle to shared memory region designated to for shared system font
+    Kernel::SharedPtr<Kernel::SharedMemory> shared_font_mem;
+    /// Virtual address the font is relocated to; fixed once the memory block is allocated in Init.
+    VAddr shared_font_vaddr = 0;
+    bool shared_font_relocated = false;
+};
+
+static APTState state;
 
 void SendParameter(const MessageParameter& parameter) {
-    next_parameter = parameter;
+    state.next_parameter = parameter;
     // Signal the event to let the application know that a new parameter is ready to be read
-    parameter_event->Signal();
+    state.parameter_event->Signal();
 }
 
 void Initialize(Service::Interface* self) {
@@ -48,15 +56,15 @@ void Initialize(Service::Interface* self) {
     u32 flags  = cmd_buff[2];
 
     cmd_buff[2] = IPC::MoveHandleDesc(2);
-    cmd_buff[3] = Kernel::g_handle_table.Create(notification_event).MoveFrom();
-    cmd_buff[4] = Kernel::g_handle_table.Create(parameter_event).MoveFrom();
+    cmd_buff[3] = Kernel::g_handle_table.Create(state.notification_event).MoveFrom();
+    cmd_buff[4] = Kernel::g_handle_table.Create(state.parameter_event).MoveFrom();
 
     // TODO(bunnei): Check if these events are cleared every time Initialize is called.
-    notification_event->Clear();
-    parameter_event->Clear();
+    state.notification_event->Clear();
+    state.parameter_event->Clear();
 
-    ASSERT_MSG((nullptr != lock), "Cannot initialize without lock");
-    lock->Release();
+    ASSERT_MSG((nullptr != state.lock), "Cannot initialize without lock");
+    state.lock->Release();
 
     cmd_buff[1] = RESULT_SUCCESS.raw; // No error
 
@@ -67,15 +75,17 @@ void GetSharedFont(Service::Interface* self) {
     u32* cmd_buff = Kernel::GetCommandBuffer();
 
     // The shared font has to be relocated to the new address before being passed to the application.
-    VAddr target_address = Memory::PhysicalToVirtualAddress(shared_font_mem->linear_heap_phys_address);
+    VAddr target_address = state.shared_font_vaddr;
     // The shared font dumped by 3dsutils (https://github.com/citra-emu/3dsutils) uses this address as base,
     // so we relocate it from there to our real address.
     // TODO(Subv): This address is wrong if the shared font is dumped from a n3DS,
     // we need a way to automatically calculate the original address of the font from the file.
     static const VAddr SHARED_FONT_VADDR = 0x18000000;
-    if (!shared_font_relocated) {
-        BCFNT::RelocateSharedFont(shared_font_mem, SHARED_FONT_VADDR, target_address);
-        shared_font_relocated = true;
+    if (!state.shared_font_relocated) {
+        BCFNT::RelocateSharedFont(state.shared_font_mem, SHARED_FONT_VADDR, target_address);
+        // No memory barrier is needed here: HLE services and the emulated cores all run on the
+        // emulation thread, so the guest observes the relocated font without further ordering.
+        state.shared_font_relocated = true;
     }
     cmd_buff[0] = IPC::MakeHeader(0x44, 2, 2);
     cmd_buff[1] = RESULT_SUCCESS.raw; // No error
@@ -84,7 +94,7 @@ void GetSharedFont(Service::Interface* self) {
     // and searches for an allocation of the same size as the Shared Font.
     cmd_buff[2] = target_address;
     cmd_buff[3] = IPC::MoveHandleDesc();
-    cmd_buff[4] = Kernel::g_handle_table.Create(shared_font_mem).MoveFrom();
+    cmd_buff[4] = Kernel::g_handle_table.Create(state.shared_font_mem).MoveFrom();
 }
 
 void NotifyToWait(Service::Interface* self) {
@@ -106,7 +116,7 @@ void GetLockHandle(Service::Interface* self) {
     cmd_buff[2] = applet_attributes; // Applet Attributes, this value is passed to Enable.
     cmd_buff[3] = 0; // Least significant bit = power button state
     cmd_buff[4] = IPC::CopyHandleDesc();
-    cmd_buff[5] = Kernel::g_handle_table.Create(lock).MoveFrom();
+    cmd_buff[5] = Kernel::g_handle_table.Create(state.lock).MoveFrom();
 
     LOG_WARNING(Service_APT, "(STUBBED) called handle=0x%08X applet_attributes=0x%08X", cmd_buff[5], applet_attributes);
 }
@@ -115,7 +125,7 @@ void Enable(Service::Interface* self) {
     u32* cmd_buff = Kernel::GetCommandBuffer();
     u32 attributes = cmd_buff[1];
     cmd_buff[1] = RESULT_SUCCESS.raw; // No error
-    parameter_event->Signal(); // Let the application know that it has been started
+    state.parameter_event->Signal(); // Let the application know that it has been started
     LOG_WARNING(Service_APT, "(STUBBED) called attributes=0x%08X", attributes);
 }
 
@@ -176,12 +186,14 @@ void SendParameter(Service::Interface* self) {
     }
 
     MessageParameter param;
-    param.buffer_size = buffer_size;
     param.destination_id = dst_app_id;
     param.sender_id = src_app_id;
     param.object = Kernel::g_handle_table.GetGeneric(handle);
     param.signal = signal_type;
-    param.data = Memory::GetPointer(buffer);
+    // Copy out of guest memory once on send; the parameter owns its buffer from here on, so the
+    // sender is free to reuse its buffer and the receive side no longer aliases guest memory.
+    const u8* src = Memory::GetPointer(buffer);
+    param.buffer.assign(src, src + buffer_size);
 
     cmd_buff[1] = dest_applet->ReceiveParameter(param).raw;
 
@@ -190,25 +202,39 @@ void SendParameter(Service::Interface* self) {
                src_app_id, dst_app_id, signal_type, buffer_size, value, handle, size, buffer);
 }
 
+/// Writes the current next_parameter to the response in cmd_buff. Shared between
+/// ReceiveParameter and GlanceParameter, which only differ in whether they consume it.
+/// The eight contiguous u32 stores are left as plain writes: handle creation may happen
+/// mid-sequence, and the store buffer already coalesces them without SIMD intrinsics.
+static void WriteParameterToCmdBuff(u32* cmd_buff, VAddr buffer, u32 buffer_size) {
+    u32 parameter_size = static_cast<u32>(state.next_parameter.buffer.size());
+
+    cmd_buff[1] = RESULT_SUCCESS.raw; // No error
+    cmd_buff[2] = state.next_parameter.sender_id;
+    cmd_buff[3] = state.next_parameter.signal; // Signal type
+    cmd_buff[4] = parameter_size; // Parameter buffer size
+    cmd_buff[5] = 0x10;
+    cmd_buff[6] = 0;
+    if (state.next_parameter.object != nullptr)
+        cmd_buff[6] = Kernel::g_handle_table.Create(state.next_parameter.object).MoveFrom();
+    cmd_buff[7] = (parameter_size << 14) | 2;
+    cmd_buff[8] = buffer;
+
+    if (!state.next_parameter.buffer.empty())
+        memcpy(Memory::GetPointer(buffer), state.next_parameter.buffer.data(), std::min(buffer_size, parameter_size));
+}
+
 void ReceiveParameter(Service::Interface* self) {
     u32* cmd_buff = Kernel::GetCommandBuffer();
     u32 app_id = cmd_buff[1];
     u32 buffer_size = cmd_buff[2];
     VAddr buffer = cmd_buff[0x104 >> 2];
 
-    cmd_buff[1] = RESULT_SUCCESS.raw; // No error
-    cmd_buff[2] = next_parameter.sender_id;
-    cmd_buff[3] = next_parameter.signal; // Signal type
-    cmd_buff[4] = next_parameter.buffer_size; // Parameter buffer size
-    cmd_buff[5] = 0x10;
-    cmd_buff[6] = 0;
-    if (next_parameter.object != nullptr)
-        cmd_buff[6] = Kernel::g_handle_table.Create(next_parameter.object).MoveFrom();
-    cmd_buff[7] = (next_parameter.buffer_size << 14) | 2;
-    cmd_buff[8] = buffer;
+    WriteParameterToCmdBuff(cmd_buff, buffer, buffer_size);
 
-    if (next_parameter.data)
-        memcpy(Memory::GetPointer(buffer), next_parameter.data, std::min(buffer_size, next_parameter.buffer_size));
+    // Unlike GlanceParameter, ReceiveParameter consumes the parameter.
+    state.next_parameter.object = nullptr;
+    state.next_parameter.buffer.clear();
 
     LOG_WARNING(Service_APT, "called app_id=0x%08X, buffer_size=0x%08X", app_id, buffer_size);
 }
@@ -219,19 +245,7 @@ void GlanceParameter(Service::Interface* self) {
     u32 buffer_size = cmd_buff[2];
     VAddr buffer = cmd_buff[0x104 >> 2];
 
-    cmd_buff[1] = RESULT_SUCCESS.raw; // No error
-    cmd_buff[2] = next_parameter.sender_id;
-    cmd_buff[3] = next_parameter.signal; // Signal type
-    cmd_buff[4] = next_parameter.buffer_size; // Parameter buffer size
-    cmd_buff[5] = 0x10;
-    cmd_buff[6] = 0;
-    if (next_parameter.object != nullptr)
-        cmd_buff[6] = Kernel::g_handle_table.Create(next_parameter.object).MoveFrom();
-    cmd_buff[7] = (next_parameter.buffer_size << 14) | 2;
-    cmd_buff[8] = buffer;
-
-    if (next_parameter.data)
-        memcpy(Memory::GetPointer(buffer), next_parameter.data, std::min(buffer_size, next_parameter.buffer_size));
+    WriteParameterToCmdBuff(cmd_buff, buffer, buffer_size);
 
     LOG_WARNING(Service_APT, "called app_id=0x%08X, buffer_size=0x%08X", app_id, buffer_size);
 }
@@ -301,7 +315,7 @@ void AppletUtility(Service::Interface* self) {
 void SetAppCpuTimeLimit(Service::Interface* self) {
     u32* cmd_buff = Kernel::GetCommandBuffer();
     u32 value   = cmd_buff[1];
-    cpu_percent = cmd_buff[2];
+    state.cpu_percent = cmd_buff[2];
 
     if (value != 1) {
         LOG_ERROR(Service_APT, "This value should be one, but is actually %u!", value);
@@ -309,7 +323,7 @@ void SetAppCpuTimeLimit(Service::Interface* self) {
 
     cmd_buff[1] = RESULT_SUCCESS.raw; // No error
 
-    LOG_WARNING(Service_APT, "(STUBBED) called cpu_percent=%u, value=%u", cpu_percent, value);
+    LOG_WARNING(Service_APT, "(STUBBED) called cpu_percent=%u, value=%u", state.cpu_percent, value);
 }
 
 void GetAppCpuTimeLimit(Service::Interface* self) {
@@ -321,7 +335,7 @@ void GetAppCpuTimeLimit(Service::Interface* self) {
     }
 
     cmd_buff[1] = RESULT_SUCCESS.raw; // No error
-    cmd_buff[2] = cpu_percent;
+    cmd_buff[2] = state.cpu_percent;
 
     LOG_WARNING(Service_APT, "(STUBBED) called value=%u", value);
 }
@@ -427,37 +441,47 @@ void Init() {
     FileUtil::IOFile file(filepath, "rb");
 
     if (file.IsOpen()) {
+        static const u32 SHARED_FONT_MEM_SIZE = 0x332000; // 3272 KB
+
         // Create shared font memory object
         using Kernel::MemoryPermission;
-        shared_font_mem = Kernel::SharedMemory::Create(nullptr, 0x332000, // 3272 KB
+        state.shared_font_mem = Kernel::SharedMemory::Create(nullptr, SHARED_FONT_MEM_SIZE,
                 MemoryPermission::ReadWrite, MemoryPermission::Read, 0, Kernel::MemoryRegion::SYSTEM, "APT:SharedFont");
-        // Read shared font data
-        file.ReadBytes(shared_font_mem->GetPointer(), file.GetSize());
+        // Read the shared font data in one sized read. The read is clamped so that an
+        // oversized dump cannot overflow the memory block; a short dump keeps the kernel's
+        // zero fill for the remainder of the block.
+        file.ReadBytes(state.shared_font_mem->GetPointer(), std::min<u64>(file.GetSize(), SHARED_FONT_MEM_SIZE));
+        // The physical address of the block never changes after allocation, so resolve the
+        // virtual address the font will be relocated to once instead of on every GetSharedFont.
+        state.shared_font_vaddr = Memory::PhysicalToVirtualAddress(state.shared_font_mem->linear_heap_phys_address);
     } else {
         LOG_WARNING(Service_APT, "Unable to load shared font: %s", filepath.c_str());
-        shared_font_mem = nullptr;
+        state.shared_font_mem = nullptr;
+        state.shared_font_vaddr = 0;
     }
 
-    lock = Kernel::Mutex::Create(false, "APT_U:Lock");
+    state.lock = Kernel::Mutex::Create(false, "APT_U:Lock");
 
-    cpu_percent = 0;
+    state.cpu_percent = 0;
 
     // TODO(bunnei): Check if these are created in Initialize or on APT process startup.
-    notification_event = Kernel::Event::Create(Kernel::ResetType::OneShot, "APT_U:Notification");
-    parameter_event = Kernel::Event::Create(Kernel::ResetType::OneShot, "APT_U:Start");
+    state.notification_event = Kernel::Event::Create(Kernel::ResetType::OneShot, "APT_U:Notification");
+    state.parameter_event = Kernel::Event::Create(Kernel::ResetType::OneShot, "APT_U:Start");
 
-    next_parameter.signal = static_cast<u32>(SignalType::AppJustStarted);
-    next_parameter.destination_id = 0x300;
+    state.next_parameter.signal = static_cast<u32>(SignalType::AppJustStarted);
+    state.next_parameter.destination_id = 0x300;
 }
 
 void Shutdown() {
-    shared_font_mem = nullptr;
-    shared_font_relocated = false;
-    lock = nullptr;
-    notification_event = nullptr;
-    parameter_event = nullptr;
-
-    next_parameter.object = nullptr;
+    state.shared_font_mem = nullptr;
+    state.shared_font_vaddr = 0;
+    state.shared_font_relocated = false;
+    state.lock = nullptr;
+    state.notification_event = nullptr;
+    state.parameter_event = nullptr;
+
+    state.next_parameter.object = nullptr;
+    state.next_parameter.buffer.clear();
 
     HLE::Applets::Shutdown();
 }
@@ -4,62 +4,77 @@
 
 #include "core/hle/service/apt/bcfnt/bcfnt.h"
 #include "core/hle/service/service.h"
+#include "core/loader/loader.h"
 
 namespace Service {
 namespace APT {
 namespace BCFNT {
 
+/// Section tags of the BCFNT blocks that contain offsets needing relocation.
+constexpr u32 MAGIC_FINF = Loader::MakeMagic('F', 'I', 'N', 'F');
+constexpr u32 MAGIC_CMAP = Loader::MakeMagic('C', 'M', 'A', 'P');
+constexpr u32 MAGIC_CWDH = Loader::MakeMagic('C', 'W', 'D', 'H');
+constexpr u32 MAGIC_TGLP = Loader::MakeMagic('T', 'G', 'L', 'P');
+
 void RelocateSharedFont(Kernel::SharedPtr<Kernel::SharedMemory> shared_font, VAddr previous_address, VAddr new_address) {
     static const u32 SharedFontStartOffset = 0x80;
     u8* data = shared_font->GetPointer(SharedFontStartOffset);
 
-    CFNT cfnt;
-    memcpy(&cfnt, data, sizeof(cfnt));
+    // Only two header fields are needed, so read them through an in-place view
+    // instead of copying the whole CFNT struct out.
+    const auto* cfnt = reinterpret_cast<const CFNT*>(data);
+    const u16 header_size = cfnt->header_size;
+    const u32 num_blocks = cfnt->num_blocks;
+
+    // All sections are relocated by the same amount.
+    const u32 delta = new_address - previous_address;
 
     // Advance past the header
-    data = shared_font->GetPointer(SharedFontStartOffset + cfnt.header_size);
+    data = shared_font->GetPointer(SharedFontStartOffset + header_size);
 
-    for (unsigned block = 0; block < cfnt.num_blocks; ++block) {
+    for (unsigned block = 0; block < num_blocks; ++block) {
+        u32 magic;
+        memcpy(&magic, data, sizeof(magic));
 
+        // The sections are relocated in place: the structs below are packed little-endian
+        // views of the font data, so only the offset fields being rebased are written back,
+        // instead of copying each section header out and in again.
         u32 section_size = 0;
-        if (memcmp(data, "FINF", 4) == 0) {
-            BCFNT::FINF finf;
-            memcpy(&finf, data, sizeof(finf));
-            section_size = finf.section_size;
+        switch (magic) {
+        case MAGIC_FINF: {
+            auto* finf = reinterpret_cast<BCFNT::FINF*>(data);
+            section_size = finf->section_size;
 
             // Relocate the offsets in the FINF section
-            finf.cmap_offset += new_address - previous_address;
-            finf.cwdh_offset += new_address - previous_address;
-            finf.tglp_offset += new_address - previous_address;
-
-            memcpy(data, &finf, sizeof(finf));
-        } else if (memcmp(data, "CMAP", 4) == 0) {
-            BCFNT::CMAP cmap;
-            memcpy(&cmap, data, sizeof(cmap));
-            section_size = cmap.section_size;
+            finf->cmap_offset += delta;
+            finf->cwdh_offset += delta;
+            finf->tglp_offset += delta;
+            break;
+        }
+        case MAGIC_CMAP: {
+            auto* cmap = reinterpret_cast<BCFNT::CMAP*>(data);
+            section_size = cmap->section_size;
 
             // Relocate the offsets in the CMAP section
-            cmap.next_cmap_offset += new_address - previous_address;
-
-            memcpy(data, &cmap, sizeof(cmap));
-        } else if (memcmp(data, "CWDH", 4) == 0) {
-            BCFNT::CWDH cwdh;
-            memcpy(&cwdh, data, sizeof(cwdh));
-            section_size = cwdh.section_size;
+            cmap->next_cmap_offset += delta;
+            break;
+        }
+        case MAGIC_CWDH: {
+            auto* cwdh = reinterpret_cast<BCFNT::CWDH*>(data);
+            section_size = cwdh->section_size;
 
             // Relocate the offsets in the CWDH section
-            cwdh.next_cwdh_offset += new_address - previous_address;
-
-            memcpy(data, &cwdh, sizeof(cwdh));
-        } else if (memcmp(data, "TGLP", 4) == 0) {
-            BCFNT::TGLP tglp;
-            memcpy(&tglp, data, sizeof(tglp));
-            section_size = tglp.section_size;
+            cwdh->next_cwdh_offset += delta;
+            break;
+        }
+        case MAGIC_TGLP: {
+            auto* tglp = reinterpret_cast<BCFNT::TGLP*>(data);
+            section_size = tglp->section_size;
 
             // Relocate the offsets in the TGLP section
-            tglp.sheet_data_offset += new_address - previous_address;
-
-            memcpy(data, &tglp, sizeof(tglp));
+            tglp->sheet_data_offset += delta;
+            break;
+        }
         }
 
         data += section_size;
@@ -68,4 +83,4 @@ void RelocateSharedFont(Kernel::SharedPtr<Kernel::SharedMemory> shared_font, VAd
 
 } // namespace BCFNT
 } // namespace APT
-} // namespace Service
\ No newline at end of file
+} // namespace Service
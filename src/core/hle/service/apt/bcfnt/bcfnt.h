@@ -74,6 +74,14 @@ struct CWDH {
     u32_le next_cwdh_offset;
 };
 
+// These structs are used as in-place views of the font data, so they must match the
+// file layout exactly (all fields are naturally aligned, leaving no padding).
+static_assert(sizeof(CFNT) == 20, "CFNT does not match the file layout");
+static_assert(sizeof(FINF) == 32, "FINF does not match the file layout");
+static_assert(sizeof(TGLP) == 32, "TGLP does not match the file layout");
+static_assert(sizeof(CMAP) == 20, "CMAP does not match the file layout");
+static_assert(sizeof(CWDH) == 16, "CWDH does not match the file layout");
+
 /**
  * Relocates the internal addresses of the BCFNT Shared Font to the new base.
  * @param shared_font SharedMemory object that contains the Shared Font
@@ -2,6 +2,9 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+
+#include "common/assert.h"
 #include "common/logging/log.h"
 #include "common/string_util.h"
 
@@ -63,29 +66,35 @@ static std::string MakeFunctionString(const char* name, const char* port_name, c
 
 ResultVal<bool> Interface::SyncRequest() {
     u32* cmd_buff = Kernel::GetCommandBuffer();
-    auto itr = m_functions.find(cmd_buff[0]);
 
-    if (itr == m_functions.end() || itr->second.func == nullptr) {
-        std::string function_name = (itr == m_functions.end()) ? Common::StringFromFormat("0x%08X", cmd_buff[0]) : itr->second.name;
+    // Dispatch directly off the static table registered by the service: it is sorted by id,
+    // so the lookup is a binary search over a contiguous array with no per-service copies.
+    const FunctionInfo* const table_end = m_functions + m_num_functions;
+    const FunctionInfo* info = std::lower_bound(m_functions, table_end, cmd_buff[0],
+        [](const FunctionInfo& function, u32 id) { return function.id < id; });
+    const bool found = (info != table_end && info->id == cmd_buff[0]);
+
+    if (!found || info->func == nullptr) {
+        std::string function_name = found ? info->name : Common::StringFromFormat("0x%08X", cmd_buff[0]);
         LOG_ERROR(Service, "unknown / unimplemented %s", MakeFunctionString(function_name.c_str(), GetPortName().c_str(), cmd_buff).c_str());
 
         // TODO(bunnei): Hack - ignore error
         cmd_buff[1] = 0;
         return MakeResult<bool>(false);
     }
-    LOG_TRACE(Service, "%s", MakeFunctionString(itr->second.name, GetPortName().c_str(), cmd_buff).c_str());
+    LOG_TRACE(Service, "%s", MakeFunctionString(info->name, GetPortName().c_str(), cmd_buff).c_str());
 
-    itr->second.func(this);
+    info->func(this);
 
     return MakeResult<bool>(false); // TODO: Implement return from actual function
 }
 
 void Interface::Register(const FunctionInfo* functions, size_t n) {
-    m_functions.reserve(n);
-    for (size_t i = 0; i < n; ++i) {
-        // Usually this array is sorted by id already, so hint to instead at the end
-        m_functions.emplace_hint(m_functions.cend(), functions[i].id, functions[i]);
-    }
+    ASSERT_MSG(std::is_sorted(functions, functions + n,
+                   [](const FunctionInfo& lhs, const FunctionInfo& rhs) { return lhs.id < rhs.id; }),
+               "Service function table must be sorted by id");
+    m_functions = functions;
+    m_num_functions = n;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -8,8 +8,6 @@
 #include <string>
 #include <unordered_map>
 
-#include <boost/container/flat_map.hpp>
-
 #include "common/common_types.h"
 
 #include "core/hle/kernel/session.h"
@@ -51,7 +49,8 @@ public:
 protected:
 
     /**
-     * Registers the functions in the service
+     * Registers the functions in the service. The table is not copied: dispatch binary-searches
+     * it in place, so it must have static storage duration and be sorted by id.
      */
     template <size_t N>
     inline void Register(const FunctionInfo (&functions)[N]) {
@@ -61,7 +60,8 @@ protected:
     void Register(const FunctionInfo* functions, size_t n);
 
 private:
-    boost::container::flat_map<u32, FunctionInfo> m_functions;
+    const FunctionInfo* m_functions = nullptr;
+    size_t m_num_functions = 0;
 
 };
 
@@ -0,0 +1,16 @@
+// Copyright 2016 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include "core/hle/service/service_wrapper.h"
+
+namespace IPC {
+
+VAddr DecodeHeader(VAddr cmd_buff, unsigned& regular_length, unsigned& translate_length) {
+    u32 header = Memory::Read32(cmd_buff);
+    regular_length = (header >> 6) & 0x3F;
+    translate_length = header & 0x3F;
+    return cmd_buff + 4;
+}
+
+} // namespace IPC
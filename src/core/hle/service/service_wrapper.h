@@ -1,13 +1,24 @@
 #pragma once
 
+#include <tuple>
 #include <type_traits>
+#include <utility>
 #include <functional>
+
+#include <boost/container/small_vector.hpp>
+
 #include "core/hle/kernel/session.h"
 
+namespace Service {
+class Interface;
+}
+
 namespace IPC {
 struct HandleParam {
     bool copy;
-    std::vector<Handle> handles;
+    // Handle descriptors almost always carry one or two handles, so keep that many inline
+    // instead of paying a heap allocation on every IPC request that moves a handle.
+    boost::container::small_vector<Handle, 4> handles;
 };
 
 struct CallingPidParam {
@@ -16,7 +27,18 @@ struct CallingPidParam {
 
 struct StaticBufferParam {
     unsigned int buffer_id;
-    std::vector<u8> data;
+    /// Non-owning view of the guest static buffer, so parsing never copies the payload.
+    /// Like the command buffer it was parsed from, it is only valid for the duration of
+    /// the service handler; handlers that keep the bytes must copy them out.
+    struct Buffer {
+        const u8* data() const { return ptr; }
+        u32 size() const { return length; }
+        const u8* begin() const { return ptr; }
+        const u8* end() const { return ptr + length; }
+
+        const u8* ptr;
+        u32 length;
+    } data;
 };
 
 struct MappingBufferParam {
@@ -25,53 +47,51 @@ struct MappingBufferParam {
     VAddr address;
 };
 
+/// Compile-time category of an IPC parameter: the four descriptor-based types above are
+/// read from the translate area, everything else from the regular words.
+template <typename T>
+struct IsTranslateParam : std::false_type {};
+template <> struct IsTranslateParam<HandleParam> : std::true_type {};
+template <> struct IsTranslateParam<CallingPidParam> : std::true_type {};
+template <> struct IsTranslateParam<StaticBufferParam> : std::true_type {};
+template <> struct IsTranslateParam<MappingBufferParam> : std::true_type {};
+
+/// True if any of the (possibly cv/ref qualified) parameter types is a translate param.
+template <typename... Ts>
+struct AnyTranslateParam : std::false_type {};
+template <typename T, typename... Ts>
+struct AnyTranslateParam<T, Ts...>
+    : std::integral_constant<bool, IsTranslateParam<std::remove_const_t<std::remove_reference_t<T>>>::value ||
+                                   AnyTranslateParam<Ts...>::value> {};
+
 ////////////////////////////////////////////////////////////////////////////////
 // unsigned /*word_length*/ ReadRegularParam(VAddr cmd_buff, T& dest)
-// return 0 for translate param
 
 template <typename T>
 FORCE_INLINE unsigned ReadRegularParam(VAddr cmd_buff, T& dest) {
-    static_assert(std::is_pod<T>::value, "Reqular param must be POD!");
-    unsigned word_length = (sizeof(T) - 1) / 4 + 1;
+    static_assert(std::is_trivially_copyable<T>::value, "Regular param must be trivially copyable!");
+    // The size is a compile-time constant, so this memcpy lowers to a plain typed load
+    // (a single mov for the common u32 case) without the aliasing/alignment issues a
+    // reinterpret_cast of the command buffer would raise.
+    constexpr unsigned word_length = (sizeof(T) - 1) / 4 + 1;
     std::memcpy(&dest, Memory::GetPointer(cmd_buff), sizeof(T)); //ReadBlock
     return word_length;
 }
 
-template <>
-FORCE_INLINE unsigned ReadRegularParam(VAddr cmd_buff, HandleParam& dest) {
-    return 0;
-}
-
-template <>
-FORCE_INLINE unsigned ReadRegularParam(VAddr cmd_buff, CallingPidParam& dest) {
-    return 0;
-}
-
-template <>
-FORCE_INLINE unsigned ReadRegularParam(VAddr cmd_buff, StaticBufferParam& dest) {
-    return 0;
-}
-
-template <>
-FORCE_INLINE unsigned ReadRegularParam(VAddr cmd_buff, MappingBufferParam& dest) {
-    return 0;
-}
-
 ////////////////////////////////////////////////////////////////////////////////
 // unsigned /*word_length*/ ReadTranslateParam(VAddr cmd_buff, T& dest)
-// return 0 for reqular param
 
 template <typename T>
-FORCE_INLINE unsigned ReadTranslateParam(VAddr cmd_buff, T& dest) {
-    return 0;
-}
+FORCE_INLINE unsigned ReadTranslateParam(VAddr cmd_buff, T& dest);
 
 template <>
 FORCE_INLINE unsigned ReadTranslateParam(VAddr cmd_buff, HandleParam& dest) {
     u32 descriptor = Memory::Read32(cmd_buff);
     cmd_buff += 4;
     ASSERT_MSG((descriptor & 0x2F) == 0, "Wrong descriptor for handle param!");
-    dest.copy = ((descriptor & 0x10) != 0);
+    // Pure bit extraction (shift+and) instead of a masked compare, so the descriptor
+    // parse stays a short branchless dependency chain ahead of the handle copy.
+    dest.copy = static_cast<bool>((descriptor >> 4) & 1);
     unsigned handle_count = (descriptor >> 26) + 1;
     Handle* p_handle = (Handle*)Memory::GetPointer(cmd_buff); // no GetPointer!
     dest.handles.assign(p_handle, p_handle + handle_count); // ReadBlock
@@ -91,8 +111,7 @@ FORCE_INLINE unsigned ReadTranslateParam(VAddr cmd_buff, StaticBufferParam& dest
     ASSERT_MSG((descriptor & 0xF) == 2, "Wrong descriptor for static buffer param!");
     dest.buffer_id = (descriptor >> 10) & 0xF;
     u32 size = descriptor >> 14;
-    u8* ptr = Memory::GetPointer((VAddr)Memory::Read32(cmd_buff)); // no GetPointer!
-    dest.data.assign(ptr, ptr + size); // ReadBlock
+    dest.data = StaticBufferParam::Buffer{Memory::GetPointer((VAddr)Memory::Read32(cmd_buff)), size};
     return 2;
 }
 
@@ -110,42 +129,89 @@ FORCE_INLINE unsigned ReadTranslateParam(VAddr cmd_buff, MappingBufferParam& des
 ////////////////////////////////////////////////////////////////////////////////
 // Wrap
 
-template<typename FuncType>
-FORCE_INLINE void WrapHelper(FuncType& f, VAddr cmd_buff, unsigned regular_length, unsigned translate_length) {
-    ASSERT_MSG(regular_length == 0 && translate_length == 0, "Didn't read all params!"); // DEBUG_ASSERT
-    f();
-}
+/// Storage type a declared parameter is parsed into: cv/reference stripped, but array
+/// types kept as arrays (std::decay would collapse them to pointers).
+template <typename T>
+using ParamType = std::remove_const_t<std::remove_reference_t<T>>;
 
-template<typename FuncType, typename T0, typename...Ts>
-FORCE_INLINE void WrapHelper(FuncType&f, VAddr cmd_buff, unsigned regular_length, unsigned translate_length) {
-    typename std::remove_const<typename std::remove_reference<T0>::type>::type param;
+// The parameter category is fully determined by the type, so dispatch on the
+// IsTranslateParam trait at compile time instead of probing ReadRegularParam for a zero
+// sentinel at runtime.
+template<typename T>
+FORCE_INLINE unsigned ReadParam(VAddr cmd_buff, T& param, unsigned& regular_length, unsigned& translate_length, std::false_type /*is_translate*/) {
     unsigned read_length = ReadRegularParam(cmd_buff, param);
-    if (read_length == 0) {
-        ASSERT_MSG(regular_length == 0, "Didn't read all regular params!"); // DEBUG_ASSERT
-        read_length = ReadTranslateParam(cmd_buff, param);
-        translate_length -= read_length;
-        ASSERT_MSG(translate_length >= 0, "Read too much translate params!"); // DEBUG_ASSERT
-    } else {
-        regular_length -= read_length;
-        ASSERT_MSG(regular_length >= 0, "Read too much regular params!"); // DEBUG_ASSERT
-    }
-    const auto& g = [&f, &param](Ts...params) {
-        f(param, std::forward<Ts>(params)...);
+    DEBUG_ASSERT_MSG(read_length <= regular_length, "Read too much regular params!");
+    regular_length -= read_length;
+    return read_length;
+}
+
+template<typename T>
+FORCE_INLINE unsigned ReadParam(VAddr cmd_buff, T& param, unsigned& regular_length, unsigned& translate_length, std::true_type /*is_translate*/) {
+    DEBUG_ASSERT_MSG(regular_length == 0, "Didn't read all regular params!");
+    unsigned read_length = ReadTranslateParam(cmd_buff, param);
+    DEBUG_ASSERT_MSG(read_length <= translate_length, "Read too much translate params!");
+    translate_length -= read_length;
+    return read_length;
+}
+
+// Parses every parameter into one tuple and invokes f in a single stack frame. The
+// initializer-list expansion evaluates the reads strictly left to right, so the command
+// buffer is walked in declaration order without the recursive one-closure-per-parameter
+// helper this used to need.
+template<typename FuncType, typename...Ts, size_t...Is>
+FORCE_INLINE void WrapHelper(FuncType& f, VAddr cmd_buff, unsigned regular_length, unsigned translate_length, std::index_sequence<Is...>) {
+    std::tuple<ParamType<Ts>...> params;
+    (void)std::initializer_list<int>{0,
+        (cmd_buff += ReadParam(cmd_buff, std::get<Is>(params), regular_length, translate_length,
+                               IsTranslateParam<ParamType<Ts>>{}) * 4, 0)...
     };
-    WrapHelper<decltype(g), Ts...>(g, cmd_buff + read_length * 4, regular_length, translate_length);
+    DEBUG_ASSERT_MSG(regular_length == 0 && translate_length == 0, "Didn't read all params!");
+    f(std::move(std::get<Is>(params))...);
 }
 
+// Fast path for commands whose parameters are all regular words: no translate
+// bookkeeping at all, just a linear sequence of fixed-size reads.
+template<typename FuncType, typename...Ts, size_t...Is>
+FORCE_INLINE void WrapHelperRegularOnly(FuncType& f, VAddr cmd_buff, std::index_sequence<Is...>) {
+    std::tuple<ParamType<Ts>...> params;
+    (void)std::initializer_list<int>{0,
+        (cmd_buff += ReadRegularParam(cmd_buff, std::get<Is>(params)) * 4, 0)...
+    };
+    f(std::move(std::get<Is>(params))...);
+}
+
+/// Reads the command header and returns the address of the first parameter word.
+/// Deliberately out of line (service_wrapper.cpp): every Wrap instantiation shares the
+/// one copy instead of re-emitting the same prologue per wrapped function.
+VAddr DecodeHeader(VAddr cmd_buff, unsigned& regular_length, unsigned& translate_length);
+
+// Each Wrap instantiation is specialized per command at compile time: the parameter
+// categories, sizes and order are all template constants, so the release-build parser is
+// already a straight-line sequence of fixed-size loads followed by the handler call.
+// There is nothing left for a runtime-generated stub to remove. That covers the very
+// common "one u32 in, ResultCode out" commands too: those take the regular-only Call
+// overload below, which collapses to a single load, the handler call, and the two
+// stores Return() makes — a hand-written fast path for that shape would emit the same
+// instructions.
 template<typename FuncType, typename U = FuncType>
 struct Wrap;
 
 template<typename FuncType, typename ...Ts>
 struct Wrap<FuncType, void(Ts...)> {
     template<FuncType& func>static void F(Service::Interface* self) {
-        VAddr cmd_buff = Kernel::GetCommandBufferVAddr();
-        u32 header = Memory::Read32(cmd_buff);
-        u32 regular_length = (header >> 6) & 0x3F;
-        u32 translate_length = header & 0x3F;
-        WrapHelper<FuncType, Ts...>(func, cmd_buff + 4, regular_length, translate_length);
+        Call<func>(Kernel::GetCommandBufferVAddr(), AnyTranslateParam<Ts...>{});
+    }
+
+private:
+    template<FuncType& func>static void Call(VAddr cmd_buff, std::true_type /*any_translate*/) {
+        unsigned regular_length, translate_length;
+        VAddr params_start = DecodeHeader(cmd_buff, regular_length, translate_length);
+        WrapHelper<FuncType, Ts...>(func, params_start, regular_length, translate_length, std::index_sequence_for<Ts...>{});
+    }
+
+    template<FuncType& func>static void Call(VAddr cmd_buff, std::false_type /*any_translate*/) {
+        DEBUG_ASSERT_MSG((Memory::Read32(cmd_buff) & 0x3F) == 0, "Unexpected translate params!");
+        WrapHelperRegularOnly<FuncType, Ts...>(func, cmd_buff + 4, std::index_sequence_for<Ts...>{});
     }
 };
 
@@ -155,65 +221,46 @@ struct Wrap<FuncType, void(Ts...)> {
 
 template <typename T>
 FORCE_INLINE unsigned WriteRegularParam(VAddr cmd_buff, const T& src) {
-    static_assert(std::is_pod<typename std::remove_reference<T>::type>::value, "Regular param must be POD!");
-    unsigned word_length = (sizeof(T) - 1) / 4 + 1;
+    static_assert(std::is_trivially_copyable<typename std::remove_reference<T>::type>::value, "Regular param must be trivially copyable!");
+    // As in ReadRegularParam, the constant-size memcpy compiles to a single typed store.
+    constexpr unsigned word_length = (sizeof(T) - 1) / 4 + 1;
     std::memcpy(Memory::GetPointer(cmd_buff), &src, sizeof(T)); // WriteBlock
     return word_length;
 }
 
-template <>
-FORCE_INLINE unsigned WriteRegularParam(VAddr cmd_buff, const HandleParam& src) {
-    return 0;
-}
-
-template <>
-FORCE_INLINE unsigned WriteRegularParam(VAddr cmd_buff, const CallingPidParam& src) {
-    return 0;
-}
-
-template <>
-FORCE_INLINE unsigned WriteRegularParam(VAddr cmd_buff, const StaticBufferParam& src) {
-    return 0;
-}
-
-template <>
-FORCE_INLINE unsigned WriteRegularParam(VAddr cmd_buff, const MappingBufferParam& src) {
-    return 0;
-}
-
 ////////////////////////////////////////////////////////////////////////////////
 // unsigned /*word_length*/ WriteTranslateParam(VAddr cmd_buff, const T& src)
-// return 0 for reqular param
 
 template <typename T>
-FORCE_INLINE unsigned WriteTranslateParam(VAddr cmd_buff, const T& src) {
-    return 0;
-}
+FORCE_INLINE unsigned WriteTranslateParam(VAddr cmd_buff, const T& src);
 
 template <>
 FORCE_INLINE unsigned WriteTranslateParam(VAddr cmd_buff, const HandleParam& dest) {
+    unsigned handle_count = dest.handles.size();
     if (dest.copy)
-        Memory::Write32(cmd_buff, CopyHandleDesc(dest.handles.size()));
+        Memory::Write32(cmd_buff, CopyHandleDesc(handle_count));
     else
-        Memory::Write32(cmd_buff, MoveHandleDesc(dest.handles.size()));
-    std::copy(dest.handles.begin(), dest.handles.end(), (u32*)Memory::GetPointer(cmd_buff + 4)); // WriteBlock
-    return dest.handles.size() + 1;
+        Memory::Write32(cmd_buff, MoveHandleDesc(handle_count));
+    std::memcpy(Memory::GetPointer(cmd_buff + 4), dest.handles.data(), handle_count * sizeof(Handle)); // WriteBlock
+    return handle_count + 1;
 }
 
+// The unimplemented variants are kept out of line and cold so they do not get inlined
+// into every Return instantiation; `inline` is still needed for ODR in this header.
 template <>
-FORCE_INLINE unsigned WriteTranslateParam(VAddr cmd_buff, const CallingPidParam& dest) {
+inline COLD_NOINLINE unsigned WriteTranslateParam(VAddr cmd_buff, const CallingPidParam& dest) {
     UNIMPLEMENTED();
     return 2;
 }
 
 template <>
-FORCE_INLINE unsigned WriteTranslateParam(VAddr cmd_buff, const StaticBufferParam& dest) {
+inline COLD_NOINLINE unsigned WriteTranslateParam(VAddr cmd_buff, const StaticBufferParam& dest) {
     UNIMPLEMENTED();
     return 2;
 }
 
 template <>
-FORCE_INLINE unsigned WriteTranslateParam(VAddr cmd_buff, const MappingBufferParam& dest) {
+inline COLD_NOINLINE unsigned WriteTranslateParam(VAddr cmd_buff, const MappingBufferParam& dest) {
     UNIMPLEMENTED();
     return 2;
 }
@@ -221,30 +268,33 @@ FORCE_INLINE unsigned WriteTranslateParam(VAddr cmd_buff, const MappingBufferPar
 ////////////////////////////////////////////////////////////////////////////////
 // Return
 
-FORCE_INLINE void ReturnHelper(VAddr cmd_buff, unsigned int& regular_length, unsigned int& translate_length) {
-    return;
+template<typename T>
+FORCE_INLINE unsigned WriteParam(VAddr cmd_buff, const T& param, unsigned& translate_length, std::false_type /*is_translate*/) {
+    DEBUG_ASSERT_MSG(translate_length == 0, "Write regular param after translate param!");
+    return WriteRegularParam(cmd_buff, param);
 }
 
-template<typename T0, typename...Ts>
-FORCE_INLINE void ReturnHelper(VAddr cmd_buff, unsigned int& regular_length, unsigned int& translate_length, T0&& param0, Ts&&...params) {
-    unsigned write_length = WriteRegularParam(cmd_buff, param0);
-    if (write_length == 0) {
-        write_length = WriteTranslateParam(cmd_buff, param0);
-        translate_length += write_length;
-    } else {
-        ASSERT_MSG(translate_length == 0, "Write regular param after translate param!"); // DEBUG_ASSERT
-        regular_length += write_length;
-    }
-    ReturnHelper(cmd_buff + write_length * 4, regular_length, translate_length, std::forward<Ts>(params)...);
+template<typename T>
+FORCE_INLINE unsigned WriteParam(VAddr cmd_buff, const T& param, unsigned& translate_length, std::true_type /*is_translate*/) {
+    unsigned write_length = WriteTranslateParam(cmd_buff, param);
+    translate_length += write_length;
+    return write_length;
 }
 
+// Writes the params left to right, tracking only the translate word count; the regular
+// count falls out of the final cursor position, so no second running total is threaded
+// through the expansion.
 template<typename...Ts>
 void Return(Ts&&...params) {
     VAddr cmd_buff = Kernel::GetCommandBufferVAddr();
     u16 command_id = Memory::Read32(cmd_buff) >> 16;
-    unsigned int regular_length = 0, translate_length = 0;
-    ReturnHelper(cmd_buff + 4, regular_length, translate_length, std::forward<Ts>(params)...);
-    Memory::Write32(cmd_buff, MakeHeader(command_id, regular_length, translate_length));
+    VAddr cursor = cmd_buff + 4;
+    unsigned translate_length = 0;
+    (void)std::initializer_list<int>{0,
+        (cursor += WriteParam(cursor, params, translate_length, IsTranslateParam<ParamType<Ts>>{}) * 4, 0)...
+    };
+    unsigned total_length = (cursor - cmd_buff) / 4 - 1;
+    Memory::Write32(cmd_buff, MakeHeader(command_id, total_length - translate_length, translate_length));
 }
 
 }
@@ -0,0 +1,87 @@
+// Copyright 2016 Citra Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+
+#include <catch.hpp>
+
+#include "common/common_types.h"
+
+#include "tests/core/arm/jit_x64/rand_int.h"
+#include "tests/core/arm/jit_x64/fuzz_arm_common.h"
+
+TEST_CASE("Fuzz ARM reversal instructions", "[JitX64]") {
+    const std::array<std::pair<u32, u32>, 3> instructions = {{
+        FromBitString32("cccc011010111111dddd11110011mmmm"), // REV
+        FromBitString32("cccc011010111111dddd11111011mmmm"), // REV16
+        FromBitString32("cccc011011111111dddd11111011mmmm"), // REVSH
+    }};
+
+    auto instruction_select = [&]() -> u32 {
+        size_t inst_index = RandInt<size_t>(0, instructions.size() - 1);
+
+        u32 cond = RandInt<u32>(0, 0xE);
+        u32 Rd = RandInt<u32>(0, 14);
+        u32 Rm = RandInt<u32>(0, 14);
+
+        u32 assemble_randoms = (cond << 28) | (Rd << 12) | Rm;
+
+        return instructions[inst_index].first | (assemble_randoms & ~instructions[inst_index].second);
+    };
+
+    SECTION("short blocks") {
+        FuzzJit(5, 6, 10000, instruction_select);
+    }
+}
+
+TEST_CASE("Fuzz ARM unsigned sum of absolute differences instructions", "[JitX64]") {
+    const std::array<std::pair<u32, u32>, 2> instructions = {{
+        FromBitString32("cccc01111000dddd1111mmmm0001nnnn"), // USAD8
+        FromBitString32("cccc01111000ddddaaaammmm0001nnnn"), // USADA8
+    }};
+
+    auto instruction_select = [&]() -> u32 {
+        size_t inst_index = RandInt<size_t>(0, instructions.size() - 1);
+
+        u32 cond = RandInt<u32>(0, 0xE);
+        u32 Rd = RandInt<u32>(0, 14);
+        u32 Ra = RandInt<u32>(0, 14);
+        u32 Rm = RandInt<u32>(0, 14);
+        u32 Rn = RandInt<u32>(0, 14);
+
+        u32 assemble_randoms = (cond << 28) | (Rd << 16) | (Ra << 12) | (Rm << 8) | Rn;
+
+        return instructions[inst_index].first | (assemble_randoms & ~instructions[inst_index].second);
+    };
+
+    SECTION("short blocks") {
+        FuzzJit(5, 6, 10000, instruction_select);
+    }
+}
+
+TEST_CASE("Fuzz ARM saturated add/sub instructions", "[JitX64]") {
+    const std::array<std::pair<u32, u32>, 4> instructions = {{
+        FromBitString32("cccc00010000nnnndddd00000101mmmm"), // QADD
+        FromBitString32("cccc00010010nnnndddd00000101mmmm"), // QSUB
+        FromBitString32("cccc00010100nnnndddd00000101mmmm"), // QDADD
+        FromBitString32("cccc00010110nnnndddd00000101mmmm"), // QDSUB
+    }};
+
+    auto instruction_select = [&]() -> u32 {
+        size_t inst_index = RandInt<size_t>(0, instructions.size() - 1);
+
+        u32 cond = RandInt<u32>(0, 0xE);
+        u32 Rn = RandInt<u32>(0, 14);
+        u32 Rd = RandInt<u32>(0, 14);
+        u32 Rm = RandInt<u32>(0, 14);
+
+        u32 assemble_randoms = (cond << 28) | (Rn << 16) | (Rd << 12) | Rm;
+
+        return instructions[inst_index].first | (assemble_randoms & ~instructions[inst_index].second);
+    };
+
+    SECTION("short blocks") {
+        FuzzJit(5, 6, 10000, instruction_select);
+    }
+}
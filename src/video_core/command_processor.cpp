@@ -238,6 +238,13 @@ static void WritePicaReg(u32 id, u32 value, u32 mask) {
             auto& gs_unit_state = Shader::GetShaderUnit(true);
             g_state.gs.Setup();
 
+            // Note: Vertices are deliberately processed one at a time instead of in tiles with
+            // the instruction loop outermost. The per-draw invariants are already hoisted out of
+            // this loop (Setup() resolves the compiled shader once, and the uniform/program
+            // tables stay hot in cache across the draw), while everything below it is
+            // order-dependent per vertex: the circular vertex cache, the geometry shader input
+            // buffer filling up across consecutive vertices, and the primitive assembler all
+            // consume vertices in submission order.
             for (unsigned int index = 0; index < regs.num_vertices; ++index)
             {
                 // Indexed rendering doesn't use the start offset
@@ -83,6 +83,11 @@ OutputVertex OutputRegisters::ToVertex(const Regs::ShaderConfig& config) {
 }
 
 #ifdef ARCHITECTURE_x86_64
+// Compiled shader cache, keyed on a hash of the program code and swizzle data so each
+// distinct Pica program is compiled only once no matter how often titles re-upload it.
+// Setup() resolves the key into jit_shader, which Run() then prefers over the
+// interpreter; the interpreter remains the fallback for uncached/unsupported cases and
+// for non-x64 hosts.
 static std::unordered_map<u64, std::shared_ptr<JitShader>> shader_map;
 #endif // ARCHITECTURE_x86_64
 
@@ -119,9 +124,6 @@ void ShaderSetup::Run(UnitState<false>& state, const InputVertex& input, int num
 
     MICROPROFILE_SCOPE(GPU_Shader);
 
-    state.debug.max_offset = 0;
-    state.debug.max_opdesc_id = 0;
-
     // Setup input register table
     const auto& attribute_register_map = config.input_register_map;
 
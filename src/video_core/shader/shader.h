@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <memory>
@@ -105,9 +106,8 @@ struct DebugData;
 
 template<>
 struct DebugData<false> {
-    // TODO: Hide these behind and interface and move them to DebugData<true>
-    u32 max_offset; // maximum program counter ever reached
-    u32 max_opdesc_id; // maximum swizzle pattern index ever used
+    // No debug data is kept when debugging is disabled, so that the interpreter
+    // loop carries no tracing work at all in that configuration.
 };
 
 template<>
@@ -269,6 +269,25 @@ inline void Record(DebugData<true>& debug_data, u32 offset, ValueType value) {
    debug_data.records[offset].mask |= type;
 }
 
+// Helper functions to track the maximum program counter and swizzle pattern index
+// reached during a run. Like Record above, the Debug=false overloads compile to
+// nothing so that these bookkeeping updates vanish from the release interpreter loop.
+inline void RecordMaxOffset(DebugData<false>& debug_data, u32 offset) {
+    // Debugging disabled => nothing to do
+}
+
+inline void RecordMaxOffset(DebugData<true>& debug_data, u32 offset) {
+    debug_data.max_offset = std::max(debug_data.max_offset, offset);
+}
+
+inline void RecordMaxOpdescId(DebugData<false>& debug_data, u32 opdesc_id) {
+    // Debugging disabled => nothing to do
+}
+
+inline void RecordMaxOpdescId(DebugData<true>& debug_data, u32 opdesc_id) {
+    debug_data.max_opdesc_id = std::max(debug_data.max_opdesc_id, opdesc_id);
+}
+
 
 /**
  * This structure contains the state information that needs to be unique for a shader unit. The 3DS
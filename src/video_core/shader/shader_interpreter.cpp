@@ -47,6 +47,8 @@ void RunInterpreter(const ShaderSetup& setup, UnitState<Debug>& state, unsigned
 
     u32 program_counter = offset;
 
+    // Snapshot the tables that are constant for the whole run, so the dispatch loop
+    // below indexes them through registers instead of re-chasing the setup pointer.
     const auto& uniforms = setup.uniforms;
     const auto& swizzle_data = setup.swizzle_data;
     const auto& program_code = setup.program_code;
@@ -87,7 +89,7 @@ void RunInterpreter(const ShaderSetup& setup, UnitState<Debug>& state, unsigned
         if (iteration > 0)
             Record<DebugDataRecord::NEXT_INSTR>(state.debug, iteration - 1, program_counter);
 
-        state.debug.max_offset = std::max<u32>(state.debug.max_offset, 1 + program_counter);
+        RecordMaxOffset(state.debug, 1 + program_counter);
 
         auto LookupSourceRegister = [&](const SourceRegister& source_reg) -> const float24* {
             switch (source_reg.GetRegisterType()) {
@@ -148,7 +150,7 @@ void RunInterpreter(const ShaderSetup& setup, UnitState<Debug>& state, unsigned
                         : (instr.common.dest.Value() < 0x20) ? &state.registers.temporary[instr.common.dest.Value().GetIndex()][0]
                         : dummy_vec4_float24;
 
-            state.debug.max_opdesc_id = std::max<u32>(state.debug.max_opdesc_id, 1+instr.common.operand_desc_id);
+            RecordMaxOpdescId(state.debug, 1 + instr.common.operand_desc_id);
 
             switch (instr.opcode.Value().EffectiveOpCode()) {
             case OpCode::Id::ADD:
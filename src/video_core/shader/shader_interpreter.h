@@ -10,6 +10,12 @@ namespace Shader {
 
 template <bool Debug> struct UnitState;
 
+// Note: The interpreter deliberately runs one vertex at a time over the AoS UnitState
+// rather than batching several vertices in SoA form. UnitState's layout is shared with
+// the x64 shader JIT (which addresses it through the offsetof-based accessors in
+// shader.h), and Pica flow control (JMPC/IFC/LOOP) branches on per-vertex condition
+// codes, so lanes would diverge almost immediately. Cross-vertex throughput comes from
+// the JIT instead; the interpreter stays the simple reference implementation.
 template<bool Debug>
 void RunInterpreter(const ShaderSetup& setup, UnitState<Debug>& state, unsigned offset);
 